@@ -0,0 +1,79 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/kpcpp/CMakeLists.txt"
+  "/root/repo/kpcpp/college/CMakeLists.txt"
+  "/root/repo/kpcpp/parking/CMakeLists.txt"
+  "/root/repo/kpcpp/poset/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "college/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "parking/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "poset/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "college/CMakeFiles/college_prefix_bench.dir/DependInfo.cmake"
+  "college/CMakeFiles/college_type_bench.dir/DependInfo.cmake"
+  "college/CMakeFiles/college_test.dir/DependInfo.cmake"
+  "parking/CMakeFiles/parking_lib.dir/DependInfo.cmake"
+  "parking/CMakeFiles/parking.dir/DependInfo.cmake"
+  "parking/CMakeFiles/parking_test.dir/DependInfo.cmake"
+  "parking/CMakeFiles/events_test.dir/DependInfo.cmake"
+  "parking/CMakeFiles/parking_bench.dir/DependInfo.cmake"
+  "poset/CMakeFiles/poset.dir/DependInfo.cmake"
+  "poset/CMakeFiles/poset_stress_test.dir/DependInfo.cmake"
+  "poset/CMakeFiles/poset_ndebug.dir/DependInfo.cmake"
+  "poset/CMakeFiles/poset_alloc_test.dir/DependInfo.cmake"
+  "poset/CMakeFiles/poset_file_test.dir/DependInfo.cmake"
+  "poset/CMakeFiles/poset_batch_test.dir/DependInfo.cmake"
+  "poset/CMakeFiles/poset_harness.dir/DependInfo.cmake"
+  "poset/CMakeFiles/poset_read_bench.dir/DependInfo.cmake"
+  "poset/CMakeFiles/poset_del_bench.dir/DependInfo.cmake"
+  "poset/CMakeFiles/poset_churn_bench.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/kpcpp
+# Build directory: /root/repo/_debug_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("college")
+subdirs("parking")
+subdirs("poset")